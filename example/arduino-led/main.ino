@@ -46,12 +46,21 @@ TinyWoTResponse handler_toggle(TinyWoTRequest *req, void *ctx);
 TinyWoTResponse handler_td(TinyWoTRequest *req, void *ctx);
 
 // Handlers implementing the behaviors of this Thing.
+// They are sorted by path so that `paths` below can share the same order.
 TinyWoTHandler handlers[] = {
+  {str_well_known_td, WOT_OPERATION_TYPE_READ_PROPERTY, handler_td, NULL},
   {str_led,
    WOT_OPERATION_TYPE_READ_PROPERTY | WOT_OPERATION_TYPE_WRITE_PROPERTY,
    handler_led, NULL},
   {str_toggle, WOT_OPERATION_TYPE_INVOKE_ACTION, handler_toggle, NULL},
-  {str_well_known_td, WOT_OPERATION_TYPE_READ_PROPERTY, handler_td, NULL},
+};
+
+// Paths of the handlers above, in the same (ascending) order, for
+// TinyWoT-HTTP-Simple to resolve incoming paths to handler indices.
+const char *const paths[] = {
+  str_well_known_td,
+  str_led,
+  str_toggle,
 };
 
 // The Thing.
@@ -110,6 +119,8 @@ void loop(void) {
     .linebuf_size = 128,
     .pathbuf = pathbuf,
     .pathbuf_size = 64,
+    .paths = paths,
+    .paths_size = sizeof(paths) / sizeof(const char *),
     .ctx = &client,
   };
 
@@ -120,7 +131,19 @@ void loop(void) {
     return;
   }
 
-  resp = tinywot_process(&thing, &req);
+  if (r < 0) {
+    // Unknown path; don't bother TinyWoT
+    resp.status = TINYWOT_RESPONSE_STATUS_UNSUPPORTED;
+    resp.allow = 0;
+    resp.content = NULL;
+  } else {
+    // Only the resolved handler needs to be looked at
+    TinyWoTThing resolved = {
+      .handlers = &handlers[cfg.path_index],
+      .handlers_size = 1,
+    };
+    resp = tinywot_process(&resolved, &req);
+  }
 
   r = tinywot_http_simple_send(&cfg, &resp);
   if (!r) {
@@ -97,6 +97,33 @@ typedef struct {
    * \brief Size of #pathbuf in bytes.
    */
   size_t pathbuf_size;
+  /**
+   * \brief An optional list of known HTTP resource paths.
+   *
+   * When set, the path of an incoming request is resolved against this list
+   * while the request line is parsed, and the request is rejected before any
+   * header field is read if the path is not in the list. The position of the
+   * matched path is stored into #path_index, so the caller can dispatch to the
+   * corresponding handler without scanning the whole handler table.
+   *
+   * The list must be sorted in ascending `strcmp` order, and must not contain
+   * duplicates. When `TINYWOT_HTTP_SIMPLE_USE_PROGMEM` is defined, each string
+   * must point to the flash memory (the list itself stays in RAM).
+   *
+   * Set to `NULL` to disable path resolution.
+   */
+  const char *const *paths;
+  /**
+   * \brief Number of elements in #paths.
+   */
+  size_t paths_size;
+  /**
+   * \brief Index into #paths of the path of the last received request.
+   *
+   * This is written by #tinywot_http_simple_recv when #paths is set and the
+   * path of the incoming request is found in #paths.
+   */
+  size_t path_index;
   /**
    * \brief An arbitrary context (user data) to carry.
    *
@@ -112,8 +139,20 @@ extern "C" {
 /**
  * \brief Receive and parse an incoming HTTP request.
  *
+ * If TinyWoTHTTPSimpleConfig::paths is set, the path of the request is
+ * resolved against it right after the request line is parsed. On a match, the
+ * index is stored into TinyWoTHTTPSimpleConfig::path_index; otherwise the
+ * function returns early without reading the header fields.
+ *
  * \param[inout] config A configuration object for this function to work.
  * \param[out] request A TinyWoT Web Thing request.
+ * \return
+ * - 1 on success.
+ * - 0 on failure.
+ * - -1 if TinyWoTHTTPSimpleConfig::paths is set and the requested path is not
+ *   in it. `request->op` and `request->path` are still valid, but the rest of
+ *   the request is not consumed. The caller may respond with
+ *   `TINYWOT_RESPONSE_STATUS_UNSUPPORTED` (404) directly.
  */
 int tinywot_http_simple_recv(TinyWoTHTTPSimpleConfig *config,
                              TinyWoTRequest *request);
@@ -23,6 +23,7 @@
 #define _PROGMEM PROGMEM
 #define _PSTR PSTR
 #define _strlen strlen_P
+#define _strcmp strcmp_P
 #define _strncmp strncmp_P
 #define _strspn strspn_P
 #define _snprintf snprintf_P
@@ -30,6 +31,7 @@
 #define _PROGMEM
 #define _PSTR
 #define _strlen strlen
+#define _strcmp strcmp
 #define _strncmp strncmp
 #define _strspn strspn
 #define _snprintf snprintf
@@ -275,6 +277,7 @@ static int tinywot_http_simple_extract_request_line(const char *linebuf,
     return 0;
   }
   strncpy(pathbuf, cursor_start, cursor_range);
+  pathbuf[cursor_range] = '\0';
 
   cursor_start = cursor_end + 1;
 
@@ -291,6 +294,44 @@ static int tinywot_http_simple_extract_request_line(const char *linebuf,
   return 1;
 }
 
+/**
+ * \internal
+ * \brief Resolve a HTTP resource path to its index in a sorted path list.
+ *
+ * This does a binary search over `paths`, so it takes O(log n) string
+ * comparisons instead of the O(n) scan done in `tinywot_process`.
+ *
+ * \param[in] path The path to look up.
+ * \param[in] paths A list of paths sorted in ascending `strcmp` order. When
+ * `TINYWOT_HTTP_SIMPLE_USE_PROGMEM` is defined, each string must point to the
+ * flash memory.
+ * \param[in] paths_size Number of elements in `paths`.
+ * \param[out] index Where to store the index of `path` in `paths`.
+ * \return non-0 if `path` is found in `paths`, otherwise 0.
+ */
+static int tinywot_http_simple_resolve_path(const char *path,
+                                            const char *const *paths,
+                                            size_t paths_size, size_t *index) {
+  size_t lo = 0;
+  size_t hi = paths_size;
+
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    int r = _strcmp(path, paths[mid]);
+
+    if (r == 0) {
+      *index = mid;
+      return 1;
+    } else if (r > 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return 0;
+}
+
 /**
  * \internal
  * \brief Extract useful information from a line of HTTP header field.
@@ -397,6 +438,16 @@ int tinywot_http_simple_recv(TinyWoTHTTPSimpleConfig *config,
   }
   request->path = config->pathbuf;
 
+  // Reject unknown paths before spending time on header fields
+  if (config->paths) {
+    r = tinywot_http_simple_resolve_path(config->pathbuf, config->paths,
+                                         config->paths_size,
+                                         &config->path_index);
+    if (!r) {
+      return -1;
+    }
+  }
+
   // Process HTTP header fields
   for (;;) {
     r = config->readln(config->linebuf, config->linebuf_size, config->ctx);